@@ -0,0 +1,214 @@
+/**
+ * File              : AliAnalysisTaskCentralityDispatch.cxx
+ * Author            : Anton Riedel <anton.riedel@tum.de>
+ * Date              : 17.10.2026
+ * Last Modified Date: 17.10.2026
+ * Last Modified By  : Anton Riedel <anton.riedel@tum.de>
+ */
+
+#include "AliAnalysisTaskCentralityDispatch.h"
+#include "AliAnalysisManager.h"
+#include "AliInputEventHandler.h"
+#include "AliMultSelection.h"
+#include "AliSysInfo.h"
+#include "AliVEvent.h"
+#include <TChain.h>
+#include <algorithm>
+#include <iterator>
+
+ClassImp(AliAnalysisTaskCentralityDispatch)
+
+AliAnalysisTaskCentralityDispatch::AliAnalysisTaskCentralityDispatch()
+    : AliAnalysisTaskSE(), fCentralityBinEdges(), fEstimators(),
+      fNumberOfSubsamples(0), fSysInfo(0), fMarker(nullptr), fFileHash(0),
+      fNumberOfEvents(0), fSample(kFALSE) {
+  // dummy constructor for I/O
+}
+
+AliAnalysisTaskCentralityDispatch::AliAnalysisTaskCentralityDispatch(
+    const char *name, std::vector<Double_t> CentralityBinEdges,
+    std::vector<std::string> Estimators, Int_t NumberOfSubsamples)
+    : AliAnalysisTaskSE(name), fCentralityBinEdges(CentralityBinEdges),
+      fEstimators(Estimators), fNumberOfSubsamples(NumberOfSubsamples),
+      fSysInfo(0), fMarker(nullptr), fFileHash(0), fNumberOfEvents(0),
+      fSample(kFALSE) {
+  // one exchange container per estimator and centrality bin and one per
+  // estimator, centrality bin and subsample, slot 0 is the AOD output tree of
+  // AliAnalysisTaskSE
+  for (std::size_t e = 0; e < fEstimators.size(); e++) {
+    for (Int_t b = 0; b < GetNumberOfBins(); b++) {
+      DefineOutput(GetOutputSlot(fEstimators.at(e).c_str(), b),
+                   TChain::Class());
+      for (Int_t s = 0; s < fNumberOfSubsamples; s++) {
+        DefineOutput(GetOutputSlot(fEstimators.at(e).c_str(), b, s),
+                     TChain::Class());
+      }
+    }
+  }
+}
+
+AliAnalysisTaskCentralityDispatch::~AliAnalysisTaskCentralityDispatch() {
+  delete fMarker;
+}
+
+std::string AliAnalysisTaskCentralityDispatch::ContainerName(
+    const char *Estimator, Double_t CenterMin, Double_t CenterMax,
+    Int_t Subsample) {
+  std::string Name(
+      Form("CentralityDispatch_%s_%.1f-%.1f", Estimator, CenterMin, CenterMax));
+  if (Subsample >= 0) {
+    Name += Form("_SS%d", Subsample);
+  }
+  return Name;
+}
+
+Int_t AliAnalysisTaskCentralityDispatch::GetOutputSlot(const char *Estimator,
+                                                       Int_t Bin,
+                                                       Int_t Subsample) const {
+  auto it = std::find(fEstimators.begin(), fEstimators.end(), Estimator);
+  if (it == fEstimators.end() || Bin < 0 || Bin >= GetNumberOfBins() ||
+      Subsample >= fNumberOfSubsamples) {
+    return -1;
+  }
+  Int_t Index =
+      std::distance(fEstimators.begin(), it) * GetNumberOfBins() + Bin;
+  if (Subsample < 0) {
+    return 1 + Index;
+  }
+  // subsample containers come after the containers of all bins
+  return 1 + fEstimators.size() * GetNumberOfBins() +
+         Index * fNumberOfSubsamples + Subsample;
+}
+
+Int_t AliAnalysisTaskCentralityDispatch::GetSubsample() const {
+  // mix the event identifiers with the splitmix64 finalizer, so neighbouring
+  // events end up in uncorrelated subsamples
+  auto Mix = [](ULong64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+  };
+  // the entry of the event in its input file, the chain entry depends on the
+  // files before it
+  ULong64_t Hash = Mix(fFileHash);
+  Hash = Mix(Hash ^ fInputHandler->GetTree()->GetTree()->GetReadEntry());
+  Hash = Mix(Hash ^ InputEvent()->GetRunNumber());
+  Hash = Mix(Hash ^ InputEvent()->GetPeriodNumber());
+  Hash = Mix(Hash ^ InputEvent()->GetOrbitNumber());
+  Hash = Mix(Hash ^ InputEvent()->GetBunchCrossNumber());
+  return Hash % fNumberOfSubsamples;
+}
+
+void AliAnalysisTaskCentralityDispatch::UserCreateOutputObjects() {
+  // the outputs only signal that the event belongs to a bin, the wagons do not
+  // read them
+  fMarker = new TChain("CentralityDispatchMarker");
+}
+
+Bool_t AliAnalysisTaskCentralityDispatch::UserNotify() {
+  // the subsample of every event depends on the name of its input file, hash
+  // it once per file
+  fFileHash = TString(CurrentFileName()).Hash();
+  return kTRUE;
+}
+
+void AliAnalysisTaskCentralityDispatch::UserExec(Option_t *) {
+  fSample = fSysInfo > 0 && fNumberOfEvents % fSysInfo == 0;
+  fNumberOfEvents++;
+
+  if (fSample) {
+    Stamp(nullptr);
+  }
+  DeactivateWagons();
+  Dispatch();
+  if (fSample) {
+    Stamp(this);
+  }
+}
+
+void AliAnalysisTaskCentralityDispatch::ExecuteTasks(Option_t *option) {
+  // the wagons of the selected bins are active now. Without stamps they run as
+  // usual, otherwise one by one enclosed by stamps
+  if (!fSample) {
+    AliAnalysisTaskSE::ExecuteTasks(option);
+  } else {
+    TIter Next(fTasks);
+    TTask *Task;
+    while ((Task = dynamic_cast<TTask *>(Next()))) {
+      if (!Task->IsActive()) {
+        continue;
+      }
+      Stamp(nullptr);
+      Task->Exec(option);
+      Task->ExecuteTasks(option);
+      Stamp(Task);
+    }
+  }
+  // also if UserExec is skipped for the next event, none of the wagons may run
+  // on it
+  DeactivateWagons();
+}
+
+void AliAnalysisTaskCentralityDispatch::DeactivateWagons() {
+  // the exchange containers do not own the marker, so the analysis manager
+  // never resets them and the wagons activated once would stay active. Only
+  // posting to a container activates its wagons again.
+  TIter Next(fTasks);
+  TTask *Task;
+  while ((Task = dynamic_cast<TTask *>(Next()))) {
+    Task->SetActive(kFALSE);
+  }
+}
+
+void AliAnalysisTaskCentralityDispatch::Stamp(TObject *Task) {
+  // the stamp after a task holds the CPU time and memory used since the stamp
+  // before it
+  if (!Task) {
+    AliSysInfo::AddStamp("CentralityDispatch_Begin", fNumberOfEvents, -1,
+                         kSysInfoStage);
+    return;
+  }
+  AliSysInfo::AddStamp(
+      Task->GetName(), fNumberOfEvents,
+      AliAnalysisManager::GetAnalysisManager()->GetTasks()->IndexOf(Task),
+      kSysInfoStage);
+}
+
+void AliAnalysisTaskCentralityDispatch::Dispatch() {
+
+  AliMultSelection *MultSelection = dynamic_cast<AliMultSelection *>(
+      InputEvent()->FindListObject("MultSelection"));
+  if (!MultSelection) {
+    return;
+  }
+
+  Int_t Subsample = fNumberOfSubsamples > 0 ? GetSubsample() : -1;
+
+  for (auto const &Estimator : fEstimators) {
+    Float_t Centrality =
+        MultSelection->GetMultiplicityPercentile(Estimator.c_str());
+
+    // first edge above the centrality, the bin is the one below it
+    auto upper = std::upper_bound(fCentralityBinEdges.begin(),
+                                  fCentralityBinEdges.end(), Centrality);
+    Int_t Bin = std::distance(fCentralityBinEdges.begin(), upper) - 1;
+    if (Bin < 0) {
+      continue;
+    }
+
+    // the wagons apply their own centrality cut afterwards, so an event
+    // sitting exactly on an edge is passed to both neighbouring bins
+    for (Int_t b = Bin - 1; b <= Bin; b++) {
+      if (b < 0 || b >= GetNumberOfBins() ||
+          (b == Bin - 1 && Centrality != fCentralityBinEdges.at(Bin))) {
+        continue;
+      }
+      PostData(GetOutputSlot(Estimator.c_str(), b), fMarker);
+      if (Subsample >= 0) {
+        PostData(GetOutputSlot(Estimator.c_str(), b, Subsample), fMarker);
+      }
+    }
+  }
+}
+
+void AliAnalysisTaskCentralityDispatch::Terminate(Option_t *) {}
@@ -0,0 +1,102 @@
+/**
+ * File              : AliAnalysisTaskCentralityDispatch.h
+ * Author            : Anton Riedel <anton.riedel@tum.de>
+ * Date              : 17.10.2026
+ * Last Modified Date: 17.10.2026
+ * Last Modified By  : Anton Riedel <anton.riedel@tum.de>
+ */
+
+#ifndef ALIANALYSISTASKCENTRALITYDISPATCH_H
+#define ALIANALYSISTASKCENTRALITYDISPATCH_H
+
+#include "AliAnalysisTaskSE.h"
+#include <string>
+#include <vector>
+
+class TChain;
+
+// Dispatches events to the wagons of a single centrality bin.
+//
+// The task has one exchange output container per centrality estimator and
+// centrality bin. Wagons connect their input to the container of their bin
+// instead of the common input container. Every event the centrality is looked
+// up once per estimator, the bin is found with a binary search and only the
+// container of this bin is filled. The containers are filled with an empty
+// marker chain owned by this task, the wagons read the event from the input
+// handler as usual. Before dispatching all wagons are switched off, posting to
+// a container switches on the wagons reading it, so all wagons of the other
+// bins skip the event without ever touching it.
+//
+// Optionally every event is also assigned to one of a number of subsamples.
+// The subsample is derived from the name of the input file and the entry of
+// the event in it, which every event has, also in MC, together with the run,
+// period, orbit and bunch crossing number. So it does not depend on how the
+// input is split into jobs. Every bin then has one more exchange container per
+// subsample and wagons connected to them see disjoint sets of events.
+//
+// The analysis manager runs the wagons inside of this task, so its own
+// profile stamps cannot tell them apart. With SetSysInfo, every SysInfo-th
+// event the task writes a pair of stamps of stage kSysInfoStage around its own
+// dispatching and around every wagon it runs. They are attributed to the index
+// of the task in the list of all tasks of the manager.
+class AliAnalysisTaskCentralityDispatch : public AliAnalysisTaskSE {
+public:
+  AliAnalysisTaskCentralityDispatch();
+  AliAnalysisTaskCentralityDispatch(const char *name,
+                                    std::vector<Double_t> CentralityBinEdges,
+                                    std::vector<std::string> Estimators,
+                                    Int_t NumberOfSubsamples = 0);
+  virtual ~AliAnalysisTaskCentralityDispatch();
+
+  virtual void UserCreateOutputObjects();
+  virtual void UserExec(Option_t *option);
+  virtual Bool_t UserNotify();
+  virtual void ExecuteTasks(Option_t *option);
+  virtual void Terminate(Option_t *option);
+
+  // name of the exchange container feeding the wagons of one bin
+  // (and subsample, if it is not negative)
+  static std::string ContainerName(const char *Estimator, Double_t CenterMin,
+                                   Double_t CenterMax, Int_t Subsample = -1);
+  // output slot of the exchange container feeding the wagons of one bin (and
+  // subsample, if it is not negative)
+  Int_t GetOutputSlot(const char *Estimator, Int_t Bin,
+                      Int_t Subsample = -1) const;
+  // deterministic subsample of the current event
+  Int_t GetSubsample() const;
+  Int_t GetNumberOfBins() const { return fCentralityBinEdges.size() - 1; }
+  const std::vector<Double_t> &GetCentralityBinEdges() const {
+    return fCentralityBinEdges;
+  }
+  const std::vector<std::string> &GetEstimators() const { return fEstimators; }
+  Int_t GetNumberOfSubsamples() const { return fNumberOfSubsamples; }
+  // write profile stamps every SysInfo events, 0 switches them off
+  void SetSysInfo(Int_t SysInfo) { fSysInfo = SysInfo; }
+
+  // stage (id2) of the profile stamps of this task
+  static const Int_t kSysInfoStage = 3;
+
+private:
+  AliAnalysisTaskCentralityDispatch(const AliAnalysisTaskCentralityDispatch &);
+  AliAnalysisTaskCentralityDispatch &
+  operator=(const AliAnalysisTaskCentralityDispatch &);
+
+  void Dispatch();
+  // switch off all wagons, Dispatch switches on those of the selected bins
+  void DeactivateWagons();
+  // stamp after the task, or before the next one if it is null
+  void Stamp(TObject *Task);
+
+  std::vector<Double_t> fCentralityBinEdges;
+  std::vector<std::string> fEstimators;
+  Int_t fNumberOfSubsamples;
+  Int_t fSysInfo;
+  TChain *fMarker;          //! posted to the containers of the selected bins
+  UInt_t fFileHash;         //! hash of the name of the current input file
+  Long64_t fNumberOfEvents; //! events seen so far
+  Bool_t fSample;           //! write profile stamps for the current event
+
+  ClassDef(AliAnalysisTaskCentralityDispatch, 1);
+};
+
+#endif
@@ -0,0 +1,68 @@
+/**
+ * File              : AliAnalysisTaskSubjobClock.cxx
+ * Author            : Anton Riedel <anton.riedel@tum.de>
+ * Date              : 17.10.2026
+ * Last Modified Date: 17.10.2026
+ * Last Modified By  : Anton Riedel <anton.riedel@tum.de>
+ */
+
+#include "AliAnalysisTaskSubjobClock.h"
+#include "AliAnalysisManager.h"
+#include <TH1D.h>
+#include <TList.h>
+
+ClassImp(AliAnalysisTaskSubjobClock)
+
+const char *const AliAnalysisTaskSubjobClock::kHistogramName = "SubjobClock";
+
+AliAnalysisTaskSubjobClock::AliAnalysisTaskSubjobClock()
+    : AliAnalysisTaskSE(), fOutput(nullptr), fClock(nullptr), fStopwatch(),
+      fFiles(0) {
+  // dummy constructor for I/O
+}
+
+AliAnalysisTaskSubjobClock::AliAnalysisTaskSubjobClock(const char *name)
+    : AliAnalysisTaskSE(name), fOutput(nullptr), fClock(nullptr),
+      fStopwatch(), fFiles(0) {
+  // slot 0 is the AOD output tree of AliAnalysisTaskSE
+  DefineOutput(1, TList::Class());
+}
+
+AliAnalysisTaskSubjobClock::~AliAnalysisTaskSubjobClock() {
+  // in PROOF mode the output list belongs to the framework
+  if (fOutput && !AliAnalysisManager::GetAnalysisManager()->IsProofMode()) {
+    delete fOutput;
+  }
+}
+
+void AliAnalysisTaskSubjobClock::UserCreateOutputObjects() {
+  fOutput = new TList();
+  fOutput->SetOwner(kTRUE);
+
+  fClock = new TH1D(kHistogramName, "Throughput of the subjob", 3, 0., 3.);
+  fClock->GetXaxis()->SetBinLabel(kSubjobs, "Subjobs");
+  fClock->GetXaxis()->SetBinLabel(kFiles, "Files");
+  fClock->GetXaxis()->SetBinLabel(kSeconds, "Seconds");
+  fOutput->Add(fClock);
+
+  PostData(1, fOutput);
+  fStopwatch.Start(kTRUE);
+}
+
+Bool_t AliAnalysisTaskSubjobClock::UserNotify() {
+  fFiles++;
+  return kTRUE;
+}
+
+void AliAnalysisTaskSubjobClock::UserExec(Option_t *) {}
+
+void AliAnalysisTaskSubjobClock::FinishTaskOutput() {
+  // called on the worker node after the last event, before the output is
+  // written
+  fStopwatch.Stop();
+  fClock->SetBinContent(kSubjobs, 1.);
+  fClock->SetBinContent(kFiles, fFiles);
+  fClock->SetBinContent(kSeconds, fStopwatch.RealTime());
+}
+
+void AliAnalysisTaskSubjobClock::Terminate(Option_t *) {}
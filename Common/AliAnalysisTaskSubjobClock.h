@@ -0,0 +1,55 @@
+/**
+ * File              : AliAnalysisTaskSubjobClock.h
+ * Author            : Anton Riedel <anton.riedel@tum.de>
+ * Date              : 17.10.2026
+ * Last Modified Date: 17.10.2026
+ * Last Modified By  : Anton Riedel <anton.riedel@tum.de>
+ */
+
+#ifndef ALIANALYSISTASKSUBJOBCLOCK_H
+#define ALIANALYSISTASKSUBJOBCLOCK_H
+
+#include "AliAnalysisTaskSE.h"
+#include <TStopwatch.h>
+
+class TH1D;
+class TList;
+
+// Measures the throughput of a grid subjob for the subjob planner.
+//
+// The task counts the input files of the subjob and the wall time from
+// creating the output objects until the output is written on the worker node.
+// Both are stored in the bins kFiles and kSeconds of a histogram, together
+// with a 1 in kSubjobs. MergeOutputs.C reads the histogram of every subjob
+// output it merges and adds the subjob to the history of the planner. Merged
+// outputs hold the sums over their subjobs.
+class AliAnalysisTaskSubjobClock : public AliAnalysisTaskSE {
+public:
+  AliAnalysisTaskSubjobClock();
+  AliAnalysisTaskSubjobClock(const char *name);
+  virtual ~AliAnalysisTaskSubjobClock();
+
+  virtual void UserCreateOutputObjects();
+  virtual void UserExec(Option_t *option);
+  virtual Bool_t UserNotify();
+  virtual void FinishTaskOutput();
+  virtual void Terminate(Option_t *option);
+
+  // bins of the histogram
+  enum EClockBins { kSubjobs = 1, kFiles, kSeconds };
+  // name of the histogram in the output list
+  static const char *const kHistogramName;
+
+private:
+  AliAnalysisTaskSubjobClock(const AliAnalysisTaskSubjobClock &);
+  AliAnalysisTaskSubjobClock &operator=(const AliAnalysisTaskSubjobClock &);
+
+  TList *fOutput;        //! output list holding the histogram
+  TH1D *fClock;          //! subjobs, files and seconds
+  TStopwatch fStopwatch; //! wall time since creating the output objects
+  Int_t fFiles;          //! input files opened so far
+
+  ClassDef(AliAnalysisTaskSubjobClock, 1);
+};
+
+#endif
@@ -0,0 +1 @@
+../Common/AliAnalysisTaskCentralityDispatch.cxx
\ No newline at end of file
@@ -0,0 +1 @@
+../Common/AliAnalysisTaskSubjobClock.h
\ No newline at end of file
@@ -0,0 +1 @@
+../Common/AliAnalysisTaskCentralityDispatch.h
\ No newline at end of file
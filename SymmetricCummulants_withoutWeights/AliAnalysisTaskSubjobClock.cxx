@@ -0,0 +1 @@
+../Common/AliAnalysisTaskSubjobClock.cxx
\ No newline at end of file